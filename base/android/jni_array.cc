@@ -230,6 +230,9 @@ void JavaBooleanArrayToBoolVector(JNIEnv* env,
   for (size_t i = 0; i < len; ++i) {
     out->at(i) = static_cast<bool>(values[i]);
   }
+  // JNI_ABORT: the elements were only read, so there is nothing to copy back
+  // and the JVM may release its buffer without a commit.
+  env->ReleaseBooleanArrayElements(boolean_array, values, JNI_ABORT);
 }
 
 void JavaIntArrayToIntVector(JNIEnv* env,
@@ -247,10 +250,14 @@ void JavaLongArrayToInt64Vector(JNIEnv* env,
                                 jlongArray long_array,
                                 std::vector<int64_t>* out) {
   DCHECK(out);
-  std::vector<jlong> temp;
-  JavaLongArrayToLongVector(env, long_array, &temp);
-  out->resize(0);
-  out->insert(out->begin(), temp.begin(), temp.end());
+  static_assert(sizeof(int64_t) == sizeof(jlong),
+                "int64_t and jlong must have the same size");
+  size_t len = SafeGetArrayLength(env, long_array);
+  out->resize(len);
+  if (!len)
+    return;
+  env->GetLongArrayRegion(long_array, 0, len,
+                          reinterpret_cast<jlong*>(out->data()));
 }
 
 void JavaLongArrayToLongVector(JNIEnv* env,
@@ -16,6 +16,8 @@
 
 #if defined(COMPILER_MSVC)
 #include <intrin.h>
+#elif defined(COMPILER_GCC) && defined(__LZCNT__)
+#include <x86intrin.h>
 #endif
 
 namespace base {
@@ -31,7 +33,16 @@ constexpr inline bool IsPowerOfTwo(T value) {
   // bit is set in x (e.g. 0b00000100000000) then |x-1| will have that bit set
   // to zero and all bits to its right set to 1 (e.g. 0b00000011111111). Hence
   // |x & (x-1)| is 0 iff x is a power of two.
-  return value > 0 && (value & (value - 1)) == 0;
+  //
+  // The two conditions are combined with a bitwise AND rather than && so that
+  // no short-circuit branch is emitted; this keeps the predicate branch-free
+  // when it feeds DCHECKs and alignment checks on hot paths. The bit math is
+  // done on the unsigned counterpart of T: without the short circuit,
+  // |value - 1| is evaluated for non-positive inputs too, and for the minimum
+  // value of a signed type that subtraction would overflow.
+  using UnsignedT = typename std::make_unsigned<T>::type;
+  const UnsignedT u = static_cast<UnsignedT>(value);
+  return (value > 0) & ((u & (u - 1)) == 0);
 }
 
 // Round up |size| to a multiple of alignment, which must be a power of two.
@@ -40,6 +51,15 @@ inline size_t Align(size_t size, size_t alignment) {
   return (size + alignment - 1) & ~(alignment - 1);
 }
 
+// As above, but for an alignment known at compile time. The mask folds into
+// an immediate at the call site instead of being materialized from a register,
+// and the power-of-two requirement is checked at compile time.
+template <size_t alignment>
+constexpr inline size_t Align(size_t size) {
+  static_assert(IsPowerOfTwo(alignment), "alignment must be a power of two");
+  return (size + alignment - 1) & ~(alignment - 1);
+}
+
 // CountLeadingZeroBits(value) returns the number of zero bits following the
 // most significant 1 bit in |value| if |value| is non-zero, otherwise it
 // returns {sizeof(T) * 8}.
@@ -54,12 +74,22 @@ inline size_t Align(size_t size, size_t alignment) {
 // compilers have built-ins that map to fast underlying processor instructions.
 #if defined(COMPILER_MSVC)
 
+// When building with /arch:AVX2 (which implies BMI1/ABM support), LZCNT and
+// TZCNT are available. Unlike _BitScanReverse/_BitScanForward they are defined
+// for a zero input (they return the operand width), so the zero test and the
+// index fix-up can be dropped. This only holds when the operand width matches
+// the instruction width, hence the bits == 32 / 64 checks below.
+
 template <typename T, unsigned bits = sizeof(T) * 8>
 ALWAYS_INLINE
     typename std::enable_if<std::is_unsigned<T>::value && sizeof(T) <= 4,
                             unsigned>::type
     CountLeadingZeroBits(T x) {
   static_assert(bits > 0, "invalid instantiation");
+#if defined(ARCH_CPU_X86_FAMILY) && defined(__AVX2__)
+  if (bits == 32)
+    return _lzcnt_u32(static_cast<uint32_t>(x));
+#endif
   unsigned long index;
   return LIKELY(_BitScanReverse(&index, static_cast<uint32_t>(x)))
              ? (31 - index - (32 - bits))
@@ -72,10 +102,14 @@ ALWAYS_INLINE
                             unsigned>::type
     CountLeadingZeroBits(T x) {
   static_assert(bits > 0, "invalid instantiation");
+#if defined(ARCH_CPU_X86_FAMILY) && defined(__AVX2__)
+  return static_cast<unsigned>(_lzcnt_u64(static_cast<uint64_t>(x)));
+#else
   unsigned long index;
   return LIKELY(_BitScanReverse64(&index, static_cast<uint64_t>(x)))
              ? (63 - index)
              : 64;
+#endif
 }
 
 template <typename T, unsigned bits = sizeof(T) * 8>
@@ -84,6 +118,10 @@ ALWAYS_INLINE
                             unsigned>::type
     CountTrailingZeroBits(T x) {
   static_assert(bits > 0, "invalid instantiation");
+#if defined(ARCH_CPU_X86_FAMILY) && defined(__AVX2__)
+  if (bits == 32)
+    return _tzcnt_u32(static_cast<uint32_t>(x));
+#endif
   unsigned long index;
   return LIKELY(_BitScanForward(&index, static_cast<uint32_t>(x))) ? index
                                                                    : bits;
@@ -95,9 +133,13 @@ ALWAYS_INLINE
                             unsigned>::type
     CountTrailingZeroBits(T x) {
   static_assert(bits > 0, "invalid instantiation");
+#if defined(ARCH_CPU_X86_FAMILY) && defined(__AVX2__)
+  return static_cast<unsigned>(_tzcnt_u64(static_cast<uint64_t>(x)));
+#else
   unsigned long index;
   return LIKELY(_BitScanForward64(&index, static_cast<uint64_t>(x))) ? index
                                                                      : 64;
+#endif
 }
 
 ALWAYS_INLINE uint32_t CountLeadingZeroBits32(uint32_t x) {
@@ -125,6 +167,16 @@ ALWAYS_INLINE
                             unsigned>::type
     CountLeadingZeroBits(T value) {
   static_assert(bits > 0, "invalid instantiation");
+#if defined(__LZCNT__)
+  // LZCNT is defined for a zero input (it returns the operand width), unlike
+  // __builtin_clz, so the zero test and the CMOV it compiles to can be
+  // skipped when the target guarantees the instruction. Only the exact 32-
+  // and 64-bit widths match the instruction's zero result.
+  if (bits == 64)
+    return static_cast<unsigned>(__lzcnt64(static_cast<uint64_t>(value)));
+  if (bits == 32)
+    return __lzcnt32(static_cast<uint32_t>(value));
+#endif
   return LIKELY(value)
              ? bits == 64
                    ? __builtin_clzll(static_cast<uint64_t>(value))
@@ -178,6 +230,26 @@ inline int Log2Ceiling(uint32_t n) {
   return (n ? 32 : -1) - CountLeadingZeroBits(n - 1);
 }
 
+#if defined(ARCH_CPU_64_BITS)
+
+// 64-bit counterparts of Log2Floor() / Log2Ceiling(). Callers operating on
+// size_t values should prefer these to avoid narrowing to 32 bits first.
+
+// Returns the integer i such as 2^i <= n < 2^(i+1)
+inline int Log2Floor64(uint64_t n) {
+  return 63 - static_cast<int>(CountLeadingZeroBits64(n));
+}
+
+// Returns the integer i such as 2^(i-1) < n <= 2^i
+inline int Log2Ceiling64(uint64_t n) {
+  // As in Log2Ceiling() above: when n == 0, (n - 1) underflows to all ones,
+  // whose CountLeadingZeroBits64 is 0, and the leading (n ? 64 : -1) makes the
+  // function return -1.
+  return (n ? 64 : -1) - static_cast<int>(CountLeadingZeroBits64(n - 1));
+}
+
+#endif  // defined(ARCH_CPU_64_BITS)
+
 }  // namespace bits
 }  // namespace base
 
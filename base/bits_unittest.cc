@@ -50,6 +50,47 @@ TEST(BitsTest, Log2Ceiling) {
   EXPECT_EQ(32, Log2Ceiling(0xffffffffU));
 }
 
+#if defined(ARCH_CPU_64_BITS)
+
+TEST(BitsTest, Log2Floor64) {
+  EXPECT_EQ(-1, Log2Floor64(0));
+  EXPECT_EQ(0, Log2Floor64(1));
+  EXPECT_EQ(1, Log2Floor64(2));
+  EXPECT_EQ(1, Log2Floor64(3));
+  EXPECT_EQ(2, Log2Floor64(4));
+  for (int i = 3; i < 63; ++i) {
+    uint64_t value = uint64_t{1} << i;
+    EXPECT_EQ(i, Log2Floor64(value));
+    EXPECT_EQ(i, Log2Floor64(value + 1));
+    EXPECT_EQ(i, Log2Floor64(value + 2));
+    EXPECT_EQ(i - 1, Log2Floor64(value - 1));
+    EXPECT_EQ(i - 1, Log2Floor64(value - 2));
+  }
+  EXPECT_EQ(63, Log2Floor64(uint64_t{1} << 63));
+  EXPECT_EQ(63, Log2Floor64(0xffffffffffffffffULL));
+}
+
+TEST(BitsTest, Log2Ceiling64) {
+  EXPECT_EQ(-1, Log2Ceiling64(0));
+  EXPECT_EQ(0, Log2Ceiling64(1));
+  EXPECT_EQ(1, Log2Ceiling64(2));
+  EXPECT_EQ(2, Log2Ceiling64(3));
+  EXPECT_EQ(2, Log2Ceiling64(4));
+  for (int i = 3; i < 63; ++i) {
+    uint64_t value = uint64_t{1} << i;
+    EXPECT_EQ(i, Log2Ceiling64(value));
+    EXPECT_EQ(i + 1, Log2Ceiling64(value + 1));
+    EXPECT_EQ(i + 1, Log2Ceiling64(value + 2));
+    EXPECT_EQ(i, Log2Ceiling64(value - 1));
+    EXPECT_EQ(i, Log2Ceiling64(value - 2));
+  }
+  EXPECT_EQ(63, Log2Ceiling64(uint64_t{1} << 63));
+  EXPECT_EQ(64, Log2Ceiling64((uint64_t{1} << 63) + 1));
+  EXPECT_EQ(64, Log2Ceiling64(0xffffffffffffffffULL));
+}
+
+#endif  // ARCH_CPU_64_BITS
+
 TEST(BitsTest, Align) {
   const size_t kSizeTMax = std::numeric_limits<size_t>::max();
   EXPECT_EQ(0ul, Align(0, 4));
@@ -62,6 +103,19 @@ TEST(BitsTest, Align) {
   EXPECT_EQ(kSizeTMax / 2 + 1, Align(1, kSizeTMax / 2 + 1));
 }
 
+TEST(BitsTest, AlignTemplate) {
+  const size_t kSizeTMax = std::numeric_limits<size_t>::max();
+  EXPECT_EQ(0ul, Align<4>(0));
+  EXPECT_EQ(4ul, Align<4>(1));
+  EXPECT_EQ(4096ul, Align<4096>(1));
+  EXPECT_EQ(4096ul, Align<4096>(4096));
+  EXPECT_EQ(4096ul, Align<4096>(4095));
+  EXPECT_EQ(8192ul, Align<4096>(4097));
+  EXPECT_EQ(kSizeTMax - 31, Align<32>(kSizeTMax - 62));
+  static_assert(Align<4096>(4097) == 8192,
+                "Align<> must be usable in constant expressions");
+}
+
 TEST(BitsTest, CountLeadingZeroBits8) {
   EXPECT_EQ(8u, CountLeadingZeroBits(uint8_t{0}));
   EXPECT_EQ(7u, CountLeadingZeroBits(uint8_t{1}));
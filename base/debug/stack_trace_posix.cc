@@ -869,13 +869,37 @@ char* itoa_r(intptr_t i, char* buf, size_t sz, int base, size_t padding) {
       return nullptr;
     }
 
-    // Output the next digit.
-    *ptr++ = "0123456789abcdef"[j % base];
-    j /= base;
+    // Output the next digit. The compiler can only strength-reduce the
+    // division to a multiply-and-shift when the base is a compile-time
+    // constant, so special-case the two bases the stack dumping code actually
+    // uses (10 for frame numbers and signal values, 16 for addresses).
+    if (base == 16) {
+      *ptr++ = "0123456789abcdef"[j & 15];
+      j >>= 4;
+    } else if (base == 10) {
+      *ptr++ = "0123456789abcdef"[j % 10];
+      j /= 10;
+    } else {
+      *ptr++ = "0123456789abcdef"[j % base];
+      j /= base;
+    }
 
     if (padding > 0)
       padding--;
-  } while (j > 0 || padding > 0);
+  } while (j > 0);
+
+  // Whatever padding is left after the significant digits is a plain run of
+  // '0' bytes. Emit it directly instead of iterating the divide loop above
+  // with a zero value; the run is reversed to the front with the rest of the
+  // digits below.
+  while (padding > 0) {
+    if (++n > sz) {
+      buf[0] = '\000';
+      return nullptr;
+    }
+    *ptr++ = '0';
+    padding--;
+  }
 
   // Terminate the output with a NUL character.
   *ptr = '\000';
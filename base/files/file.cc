@@ -11,6 +11,7 @@
 
 #if defined(OS_POSIX) || defined(OS_FUCHSIA)
 #include <errno.h>
+#include <fcntl.h>
 #endif
 
 namespace base {
@@ -26,12 +27,13 @@ File::Info::~Info() = default;
 File::File()
     : error_details_(FILE_ERROR_FAILED),
       created_(false),
-      async_(false) {
+      async_(false),
+      append_(false) {
 }
 
 #if !defined(OS_NACL)
 File::File(const FilePath& path, uint32_t flags)
-    : error_details_(FILE_OK), created_(false), async_(false) {
+    : error_details_(FILE_OK), created_(false), async_(false), append_(false) {
   Initialize(path, flags);
 }
 #endif
@@ -42,16 +44,25 @@ File::File(PlatformFile platform_file, bool async)
     : file_(platform_file),
       error_details_(FILE_OK),
       created_(false),
-      async_(async) {
+      async_(async),
+      append_(false) {
 #if defined(OS_POSIX) || defined(OS_FUCHSIA)
   DCHECK_GE(platform_file, -1);
+#if !defined(OS_NACL)
+  // An adopted descriptor's open flags aren't known, so query the append
+  // mode once here rather than on every Write(). NaCl doesn't implement
+  // fcntl; its write always respects O_APPEND anyway.
+  if (platform_file != -1)
+    append_ = (fcntl(platform_file, F_GETFL) & O_APPEND) != 0;
+#endif
 #endif
 }
 
 File::File(Error error_details)
     : error_details_(error_details),
       created_(false),
-      async_(false) {
+      async_(false),
+      append_(false) {
 }
 
 File::File(File&& other)
@@ -59,7 +70,8 @@ File::File(File&& other)
       tracing_path_(other.tracing_path_),
       error_details_(other.error_details()),
       created_(other.created()),
-      async_(other.async_) {}
+      async_(other.async_),
+      append_(other.append_) {}
 
 File::~File() {
   // Go through the AssertIOAllowed logic.
@@ -73,6 +85,7 @@ File& File::operator=(File&& other) {
   error_details_ = other.error_details();
   created_ = other.created();
   async_ = other.async_;
+  append_ = other.append_;
   return *this;
 }
 
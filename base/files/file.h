@@ -373,6 +373,11 @@ class BASE_EXPORT File {
   bool created_;
   bool async_;
 
+  // Whether the underlying descriptor was opened with O_APPEND. Cached so
+  // that Write() doesn't have to issue an fcntl(F_GETFL) on every call.
+  // Only meaningful on POSIX; unused on Windows.
+  bool append_;
+
   DISALLOW_COPY_AND_ASSIGN(File);
 };
 
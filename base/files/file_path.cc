@@ -6,6 +6,7 @@
 
 #include <string.h>
 #include <algorithm>
+#include <utility>
 
 #include "base/logging.h"
 #include "base/macros.h"
@@ -137,19 +138,22 @@ StringType::size_type ExtensionSeparatorPosition(const StringType& path) {
     return last_dot;
   }
 
+  // The substring is invariant across the table, so build it once instead of
+  // once per entry.
+  StringType extension(path, penultimate_dot + 1);
   for (size_t i = 0; i < arraysize(kCommonDoubleExtensions); ++i) {
-    StringType extension(path, penultimate_dot + 1);
     if (LowerCaseEqualsASCII(extension, kCommonDoubleExtensions[i]))
       return penultimate_dot;
   }
 
-  StringType extension(path, last_dot + 1);
-  for (size_t i = 0; i < arraysize(kCommonDoubleExtensionSuffixes); ++i) {
-    if (LowerCaseEqualsASCII(extension, kCommonDoubleExtensionSuffixes[i])) {
-      if ((last_dot - penultimate_dot) <= 5U &&
-          (last_dot - penultimate_dot) > 1U) {
+  // A suffix match only counts when the middle component is 1-4 characters
+  // (plus its dot); that bound doesn't depend on the table entry either, so
+  // check it before scanning.
+  if ((last_dot - penultimate_dot) <= 5U && (last_dot - penultimate_dot) > 1U) {
+    extension.assign(path, last_dot + 1, StringType::npos);
+    for (size_t i = 0; i < arraysize(kCommonDoubleExtensionSuffixes); ++i) {
+      if (LowerCaseEqualsASCII(extension, kCommonDoubleExtensionSuffixes[i]))
         return penultimate_dot;
-      }
     }
   }
 
@@ -230,18 +234,23 @@ void FilePath::GetComponents(std::vector<StringType>* components) const {
   FilePath current = *this;
   FilePath base;
 
-  // Capture path components.
-  while (current != current.DirName()) {
+  // Capture path components. DirName() is the expensive step (it copies the
+  // path and rescans it), so compute it once per level instead of once in the
+  // loop condition and again in the body.
+  for (;;) {
+    FilePath dir = current.DirName();
+    if (current == dir)
+      break;
     base = current.BaseName();
     if (!AreAllSeparators(base.value()))
       ret_val.push_back(base.value());
-    current = current.DirName();
+    current = std::move(dir);
   }
 
   // Capture root, if any.
   base = current.BaseName();
   if (!base.value().empty() && base.value() != kCurrentDirectory)
-    ret_val.push_back(current.BaseName().value());
+    ret_val.push_back(base.value());
 
   // Capture drive letter, if any.
   FilePath dir = current.DirName();
@@ -250,7 +259,7 @@ void FilePath::GetComponents(std::vector<StringType>* components) const {
     ret_val.push_back(StringType(dir.value(), 0, letter + 1));
   }
 
-  *components = std::vector<StringType>(ret_val.rbegin(), ret_val.rend());
+  components->assign(ret_val.rbegin(), ret_val.rend());
 }
 
 bool FilePath::IsParent(const FilePath& child) const {
@@ -1280,12 +1289,23 @@ int FilePath::CompareIgnoreCase(StringPieceType string1,
 // Generic Posix system comparisons.
 int FilePath::CompareIgnoreCase(StringPieceType string1,
                                 StringPieceType string2) {
-  // Specifically need null termianted strings for this API call.
-  int comparison = strcasecmp(string1.as_string().c_str(),
-                              string2.as_string().c_str());
-  if (comparison < 0)
+  // Compare the pieces in place rather than materializing null-terminated
+  // copies for strcasecmp(). The folding is ASCII-only and bytes compare as
+  // unsigned, matching what strcasecmp does in the C locale.
+  size_t common_length = std::min(string1.length(), string2.length());
+  for (size_t i = 0; i < common_length; ++i) {
+    unsigned char c1 =
+        static_cast<unsigned char>(ToLowerASCII(string1[i]));
+    unsigned char c2 =
+        static_cast<unsigned char>(ToLowerASCII(string2[i]));
+    if (c1 < c2)
+      return -1;
+    if (c1 > c2)
+      return 1;
+  }
+  if (string1.length() < string2.length())
     return -1;
-  if (comparison > 0)
+  if (string1.length() > string2.length())
     return 1;
   return 0;
 }
@@ -1301,18 +1321,23 @@ void FilePath::StripTrailingSeparatorsInternal() {
   // the drive letter.
   StringType::size_type start = FindDriveLetter(path_) + 2;
 
-  StringType::size_type last_stripped = StringType::npos;
-  for (StringType::size_type pos = path_.length();
-       pos > start && IsSeparator(path_[pos - 1]);
-       --pos) {
-    // If the string only has two separators and they're at the beginning,
-    // don't strip them, unless the string began with more than two separators.
-    if (pos != start + 1 || last_stripped == start + 2 ||
-        !IsSeparator(path_[start - 1])) {
-      path_.resize(pos - 1);
-      last_stripped = pos;
-    }
+  // Find the extent of the trailing separator run in a single backwards scan
+  // and shrink the string once, rather than resizing for every separator
+  // stripped.
+  StringType::size_type pos = path_.length();
+  while (pos > start && IsSeparator(path_[pos - 1]))
+    --pos;
+
+  // If the scan bottomed out at |start| and the string consisted of exactly
+  // two separators (possibly after a drive letter), keep both: a leading
+  // double separator indicates an alternate root.  A run of more than two
+  // separators, or a single one, is still stripped down to |start|.
+  if (pos == start && path_.length() == start + 1 &&
+      IsSeparator(path_[start - 1])) {
+    return;
   }
+
+  path_.resize(pos);
 }
 
 FilePath FilePath::NormalizePathSeparators() const {
@@ -1324,8 +1349,11 @@ FilePath FilePath::NormalizePathSeparatorsTo(CharType separator) const {
   DCHECK_NE(kSeparators + kSeparatorsLength,
             std::find(kSeparators, kSeparators + kSeparatorsLength, separator));
   StringType copy = path_;
-  for (size_t i = 0; i < kSeparatorsLength; ++i) {
-    std::replace(copy.begin(), copy.end(), kSeparators[i], separator);
+  // Rewrite every separator in one pass over the string instead of one
+  // std::replace() traversal per entry in kSeparators.
+  for (StringType::iterator it = copy.begin(); it != copy.end(); ++it) {
+    if (IsSeparator(*it))
+      *it = separator;
   }
   return FilePath(copy);
 #else
@@ -46,10 +46,6 @@ int CallFstat(int fd, stat_wrapper_t *sb) {
 // NaCl doesn't provide the following system calls, so either simulate them or
 // wrap them in order to minimize the number of #ifdef's in this file.
 #if !defined(OS_NACL) && !defined(OS_AIX)
-bool IsOpenAppend(PlatformFile file) {
-  return (fcntl(file, F_GETFL) & O_APPEND) != 0;
-}
-
 int CallFtruncate(PlatformFile file, int64_t length) {
   return HANDLE_EINTR(ftruncate(file, length));
 }
@@ -86,13 +82,6 @@ File::Error CallFcntlFlock(PlatformFile file, bool do_lock) {
 
 #else   // defined(OS_NACL) && !defined(OS_AIX)
 
-bool IsOpenAppend(PlatformFile file) {
-  // NaCl doesn't implement fcntl. Since NaCl's write conforms to the POSIX
-  // standard and always appends if the file is opened with O_APPEND, just
-  // return false here.
-  return false;
-}
-
 int CallFtruncate(PlatformFile file, int64_t length) {
   NOTIMPLEMENTED();  // NaCl doesn't implement ftruncate.
   return 0;
@@ -265,7 +254,11 @@ int File::ReadAtCurrentPosNoBestEffort(char* data, int size) {
 int File::Write(int64_t offset, const char* data, int size) {
   AssertBlockingAllowed();
 
-  if (IsOpenAppend(file_.get()))
+  // |append_| is captured when the descriptor is created, so Write() doesn't
+  // pay for an fcntl(F_GETFL) on every call. On NaCl (where fcntl isn't
+  // implemented) it stays false; NaCl's write conforms to POSIX and appends
+  // on its own when the file was opened with O_APPEND.
+  if (append_)
     return WriteAtCurrentPos(data, size);
 
   DCHECK(IsValid());
@@ -489,6 +482,15 @@ void File::DoInitialize(const FilePath& path, uint32_t flags) {
   else if (flags & FLAG_APPEND)
     open_flags |= O_APPEND | O_WRONLY;
 
+#if !defined(OS_AIX)
+  // Set the close-on-exec bit atomically at open() rather than with a separate
+  // fcntl(F_SETFD): a child spawned by another thread between the two calls
+  // would inherit the descriptor. Children that should receive a descriptor
+  // get it explicitly through the launch fd-remapping, whose dup2() clears the
+  // flag on the child's copy. (AIX's open() doesn't support O_CLOEXEC.)
+  open_flags |= O_CLOEXEC;
+#endif
+
   static_assert(O_RDONLY == 0, "O_RDONLY must equal zero");
 
   int mode = S_IRUSR | S_IWUSR;
@@ -522,6 +524,7 @@ void File::DoInitialize(const FilePath& path, uint32_t flags) {
     unlink(path.value().c_str());
 
   async_ = ((flags & FLAG_ASYNC) == FLAG_ASYNC);
+  append_ = ((flags & FLAG_APPEND) == FLAG_APPEND);
   error_details_ = FILE_OK;
   file_.reset(descriptor);
 }
@@ -246,7 +246,8 @@ uint32_t SamplingHeapProfiler::Start() {
 #endif
   InstallAllocatorHooksOnce();
   base::subtle::Barrier_AtomicIncrement(&g_running, 1);
-  return last_sample_ordinal_;
+  return static_cast<uint32_t>(
+      base::subtle::NoBarrier_Load(&last_sample_ordinal_));
 }
 
 void SamplingHeapProfiler::Stop() {
@@ -359,7 +360,9 @@ void SamplingHeapProfiler::DoRecordAlloc(size_t total_allocated,
   entered_.Set(true);
   {
     base::AutoLock lock(mutex_);
-    Sample sample(size, total_allocated, ++last_sample_ordinal_);
+    Sample sample(size, total_allocated,
+                  static_cast<uint32_t>(base::subtle::NoBarrier_AtomicIncrement(
+                      &last_sample_ordinal_, 1)));
     RecordStackTrace(&sample, skip_frames);
     for (auto* observer : observers_)
       observer->SampleAdded(sample.ordinal, size, total_allocated);
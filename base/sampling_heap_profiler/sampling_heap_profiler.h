@@ -10,6 +10,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "base/atomicops.h"
 #include "base/base_export.h"
 #include "base/macros.h"
 #include "base/synchronization/lock.h"
@@ -105,7 +106,10 @@ class BASE_EXPORT SamplingHeapProfiler {
   std::stack<std::unique_ptr<LockFreeAddressHashSet>> sampled_addresses_stack_;
   std::unordered_map<void*, Sample> samples_;
   std::vector<SamplesObserver*> observers_;
-  uint32_t last_sample_ordinal_ = 1;
+  // Incremented without barriers: the ordinal is a plain monotonic counter
+  // with no ordering relationship to other data, and Start() reads it outside
+  // |mutex_|.
+  subtle::Atomic32 last_sample_ordinal_ = 1;
 
   static SamplingHeapProfiler* instance_;
 
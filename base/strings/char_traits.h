@@ -33,11 +33,12 @@ template <typename T>
 constexpr int CharTraits<T>::compare(const T* s1,
                                      const T* s2,
                                      size_t n) noexcept {
+  // Test for inequality first: equal characters are by far the common case
+  // while scanning, so the loop carries a single well-predicted branch and the
+  // less-than/greater-than decision is only made once, at the first mismatch.
   for (; n; --n, ++s1, ++s2) {
-    if (*s1 < *s2)
-      return -1;
-    if (*s1 > *s2)
-      return 1;
+    if (*s1 != *s2)
+      return *s1 < *s2 ? -1 : 1;
   }
   return 0;
 }
@@ -66,11 +67,11 @@ constexpr int CharTraits<char>::compare(const char* s1,
 #if HAS_FEATURE(cxx_constexpr_string_builtins)
   return __builtin_memcmp(s1, s2, n);
 #else
+  // As in the generic version: one equality branch in the loop, ordering
+  // decided only at the first mismatch.
   for (; n; --n, ++s1, ++s2) {
-    if (*s1 < *s2)
-      return -1;
-    if (*s1 > *s2)
-      return 1;
+    if (*s1 != *s2)
+      return *s1 < *s2 ? -1 : 1;
   }
   return 0;
 #endif